@@ -59,6 +59,8 @@
 #endif
 #define RETURN_ERROR        (-1)
 #define RETURN_OK           (0)
+#define RETURN_TIMEOUT      (-2)  //!< The call did not complete before the deadline of the calling thread
+#define RETURN_CANCELLED    (-3)  //!< The call was cancelled before completion
 #ifndef TRUE
 #define TRUE                (1)
 #endif
@@ -84,6 +86,9 @@
 #define CELLULAR_SLOT_ID_UNKNOWN                  (-1)          //!< Slot ID is not present 
 #define CELLULAR_PDP_CONTEXT_UNKNOWN              (-1)          //!< Packet data protocol context is not present
 #define CELLULAR_PACKET_DATA_INVALID_HANDLE       (0xFFFFFFFF)  //!< Invalid packet data handle
+#define CELLULAR_MAX_DATA_SESSIONS                (8)           //!< Maximum number of concurrent packet data sessions, including the default session
+#define CELLULAR_NETWORK_SCAN_CACHE_TTL_DEFAULT   (0)           //!< Default TTL of cached network scan results in seconds, 0 means the cache is disabled
+#define CELLULAR_NETWORK_SCAN_CACHE_MAX_ENTRIES   (256)         //!< Maximum number of networks held by the network scan cache
 
 /*
 * TODO (Enhance Error Reporting):
@@ -216,6 +221,21 @@ typedef struct
     unsigned char bIsThisDefaultProfile; /**!< Indicates if this is the default profile (1 = true, 0 = false). */
 } CellularProfileStruct;
 
+/**! Represents the key used to look up a cellular profile. */
+typedef enum _CellularProfileKeyType_t {
+    CELLULAR_PROFILE_KEY_ID = 1,   /**!< Look up by CellularProfileStruct::ProfileID. */
+    CELLULAR_PROFILE_KEY_APN       /**!< Look up by CellularProfileStruct::APN. */
+} CellularProfileKeyType_t;
+
+/**! Represents a cellular profile lookup key. */
+typedef struct
+{
+    CellularProfileKeyType_t KeyType;   /**!< Which of the members below is used. */
+    int ProfileID;                      /**!< Profile ID, used with CELLULAR_PROFILE_KEY_ID. */
+    char APN[64];                       /**!< Access Point Name, used with CELLULAR_PROFILE_KEY_APN.
+                                             The string is zero-terminated and the terminator is included in the size. */
+} CellularProfileKeyStruct;
+
 /**!<  Represents input parameters for initializing a cellular interface. */
 typedef struct
 {
@@ -264,6 +284,37 @@ typedef  struct
                                                    The possible range of acceptable values is 1280 to 9000. */
 } CellularIPStruct;
 
+/**! Represents the result of applying the IP configuration to the WAN interface inside the HAL. */
+typedef enum _CellularIPConfigApplyStatus_t {
+    CELLULAR_IP_CONFIG_APPLY_DISABLED = 0,   /**!< The HAL does not apply the IP configuration, the caller is responsible for it. */
+    CELLULAR_IP_CONFIG_APPLY_SUCCESS,        /**!< Address, default route, MTU and link state were programmed on the WAN interface. */
+    CELLULAR_IP_CONFIG_APPLY_FAILED          /**!< Programming the WAN interface failed, the interface is left without the new configuration. */
+} CellularIPConfigApplyStatus_t;
+
+#define CELLULAR_IP_MAX_DNS_SERVERS               (4)           //!< Maximum number of DNS servers per IP family in CellularIPConfigStruct
+
+/**! Represents the dual-stack IP configuration of a cellular network connection in binary form. */
+typedef struct
+{
+    char WANIFName[16];                                          /**!< Name of the WAN interface.
+                                                                      The string is zero-terminated and the terminator is included in the size. Example: "wwan0" */
+    unsigned char IPv4Valid;                                     /**!< Whether the IPv4 members are valid (1) or not (0). */
+    struct in_addr IPv4Address;                                  /**!< IPv4 address, network byte order. */
+    unsigned char IPv4PrefixLength;                              /**!< IPv4 prefix length. The possible range is 0 to 32. */
+    struct in_addr IPv4Gateway;                                  /**!< IPv4 default gateway, network byte order. */
+    unsigned int IPv4DNSServerCount;                             /**!< Number of valid entries in IPv4DNSServers. */
+    struct in_addr IPv4DNSServers[CELLULAR_IP_MAX_DNS_SERVERS];  /**!< IPv4 DNS servers in order of preference. */
+    unsigned char IPv6Valid;                                     /**!< Whether the IPv6 members are valid (1) or not (0). */
+    struct in6_addr IPv6Address;                                 /**!< IPv6 address. */
+    unsigned char IPv6PrefixLength;                              /**!< IPv6 prefix length. The possible range is 0 to 128. */
+    struct in6_addr IPv6Gateway;                                 /**!< IPv6 default gateway. */
+    unsigned int IPv6DNSServerCount;                             /**!< Number of valid entries in IPv6DNSServers. */
+    struct in6_addr IPv6DNSServers[CELLULAR_IP_MAX_DNS_SERVERS]; /**!< IPv6 DNS servers in order of preference. */
+    unsigned int MTUSize;                                        /**!< Maximum transmission unit of the interface.
+                                                                      The possible range of acceptable values is 1280 to 9000. */
+    CellularIPConfigApplyStatus_t ApplyStatus;                   /**!< Result of applying this configuration to WANIFName, see cellular_hal_set_ip_config_apply(). */
+} CellularIPConfigStruct;
+
 /**!< Represents data transfer statistics for a cellular network connection. */
 typedef struct
 {
@@ -277,6 +328,37 @@ typedef struct
     unsigned long DownStreamMaxBitRate; /**!< Maximum downstream bit rate (bits/second). */
 } CellularPacketStatsStruct;
 
+/**!< Represents 64-bit data transfer statistics together with the change since the previous sample. */
+typedef struct
+{
+    uint64_t BytesSent;               /**!< Total bytes sent over the cellular connection. */
+    uint64_t BytesReceived;           /**!< Total bytes received over the cellular connection. */
+    uint64_t PacketsSent;             /**!< Total packets sent over the cellular connection. */
+    uint64_t PacketsReceived;         /**!< Total packets received over the cellular connection. */
+    uint64_t PacketsSentDrop;         /**!< Total packets dropped during transmission. */
+    uint64_t PacketsReceivedDrop;     /**!< Total packets dropped during reception. */
+    uint64_t UpStreamMaxBitRate;      /**!< Maximum upstream bit rate (bits/second). */
+    uint64_t DownStreamMaxBitRate;    /**!< Maximum downstream bit rate (bits/second). */
+    uint64_t Timestamp;               /**!< Time at which the counters were sampled, in milliseconds of CLOCK_MONOTONIC. */
+    uint64_t SessionStartTimestamp;   /**!< Time at which the data session started and the counters were reset, in milliseconds of CLOCK_MONOTONIC. */
+    uint64_t IntervalMs;              /**!< Time covered by the deltas and rates, in milliseconds. 0 when no previous sample was given or it
+                                           was taken in the same millisecond. The rates are 0 when IntervalMs is 0. */
+    uint64_t BytesSentDelta;          /**!< Bytes sent during IntervalMs. */
+    uint64_t BytesReceivedDelta;      /**!< Bytes received during IntervalMs. */
+    uint64_t PacketsSentDelta;        /**!< Packets sent during IntervalMs. */
+    uint64_t PacketsReceivedDelta;    /**!< Packets received during IntervalMs. */
+    uint64_t BytesSentRate;           /**!< Average send rate over IntervalMs (bytes/second). */
+    uint64_t BytesReceivedRate;       /**!< Average receive rate over IntervalMs (bytes/second). */
+    uint64_t PacketsSentRate;         /**!< Average packet send rate over IntervalMs (packets/second). */
+    uint64_t PacketsReceivedRate;     /**!< Average packet receive rate over IntervalMs (packets/second). */
+} CellularPacketStats64Struct;
+
+/**! Represents where the packet counters are read from. */
+typedef enum _CellularPacketStatsSource_t {
+    CELLULAR_PACKET_STATS_SOURCE_MODEM = 1,   /**!< Counters are queried from the modem on every call. */
+    CELLULAR_PACKET_STATS_SOURCE_NETDEV       /**!< Counters are read from the kernel IFLA_STATS64 of the WAN interface over rtnetlink. */
+} CellularPacketStatsSource_t;
+
 
 /**!< Represents the form factors of a Universal Integrated Circuit Card (UICC). */
 typedef enum _CellularUICCFormFactor_t {
@@ -343,6 +425,20 @@ typedef struct
     unsigned int servingCellId; /**!< Unique identifier of the serving cell (0 - (0xFFFFFFFFF)). */
 } CellLocationInfoStruct;
 
+/**! Represents the measurement of a serving or neighbour cell. */
+typedef struct
+{
+    unsigned char IsServingCell;                     /**!< Whether this is the serving cell (1) or a neighbour cell (0). */
+    CellularPrefAccessTechnology_t RadioTechnology;  /**!< Radio access technology of the cell (e.g., LTE, 5G). */
+    uint64_t globalCellId;                           /**!< Unique identifier of the cell: 28-bit E-UTRAN cell identity for LTE (0 - 0xFFFFFFF),
+                                                          36-bit NR cell identity for 5G NR (0 - 0xFFFFFFFFF). 0 if not decoded for a neighbour cell. */
+    unsigned int ARFCN;                              /**!< EARFCN for LTE or NR-ARFCN for 5G NR. */
+    unsigned int PCI;                                /**!< Physical cell identity (0 - 503 for LTE, 0 - 1007 for NR). */
+    unsigned int bandInfo;                           /**!< Frequency band used by the cell (0 - 0x7FFF). */
+    int RSRP;                                        /**!< Reference signal received power. The value ranges from -140 to -44 and is expressed in dBm. */
+    int RSRQ;                                        /**!< Reference signal received quality. The value ranges from -3 to -19.5 and is expressed in dB. */
+} CellularCellMeasurementStruct;
+
 /**! Represents current Public Land Mobile Network (PLMN) information for a UICC slot. */
 typedef struct
 {
@@ -365,6 +461,14 @@ typedef struct
     unsigned char network_allowed_flag; /**!< Indicates if the network is allowed (1 = true, 0 = false). */
 } CellularNetworkScanResultInfoStruct;
 
+/**! Represents the progress of a streaming network scan. */
+typedef enum _CellularNetworkScanStatus_t {
+    CELLULAR_NETWORK_SCAN_RESULT = 1,   /**!< A network was found. */
+    CELLULAR_NETWORK_SCAN_COMPLETED,    /**!< The scan finished, no more results follow. */
+    CELLULAR_NETWORK_SCAN_CANCELLED,    /**!< The scan was cancelled, no more results follow. */
+    CELLULAR_NETWORK_SCAN_FAILED        /**!< The scan failed, no more results follow. */
+} CellularNetworkScanStatus_t;
+
 /**! Indicates the detection status of a cellular device. */
 typedef enum _CellularDeviceDetectionStatus_t {
     DEVICE_DETECTED = 1, /**!< Device is detected. */
@@ -429,6 +533,329 @@ typedef enum _CellularNetworkPacketStatus_t
     DEVICE_NETWORK_STATUS_CONNECTED      /**!< Network is connected. */
 } CellularNetworkPacketStatus_t;
 
+#define CELLULAR_TELEMETRY_FIELD_INTERFACE_STATUS (1U << 0)  //!< Select CellularTelemetrySnapshotStruct::InterfaceStatus
+#define CELLULAR_TELEMETRY_FIELD_SIGNAL           (1U << 1)  //!< Select CellularTelemetrySnapshotStruct::SignalInfo
+#define CELLULAR_TELEMETRY_FIELD_PLMN             (1U << 2)  //!< Select CellularTelemetrySnapshotStruct::PlmnInfo
+#define CELLULAR_TELEMETRY_FIELD_CELL_LOCATION    (1U << 3)  //!< Select CellularTelemetrySnapshotStruct::CellLocationInfo
+#define CELLULAR_TELEMETRY_FIELD_PACKET_STATS     (1U << 4)  //!< Select CellularTelemetrySnapshotStruct::PacketStats
+#define CELLULAR_TELEMETRY_FIELD_ALL              (0x1FU)    //!< Select every telemetry field
+
+/**! Represents a consistent snapshot of the frequently polled modem telemetry. */
+typedef struct
+{
+    unsigned int FieldMask;                      /**!< Bitmask of CELLULAR_TELEMETRY_FIELD_* values which were filled by the HAL.
+                                                      Fields whose bit is not set must be ignored by the caller. */
+    uint64_t Timestamp;                          /**!< Time at which the snapshot was taken, in milliseconds of CLOCK_MONOTONIC. */
+    CellularInterfaceStatus_t InterfaceStatus;   /**!< Same value as returned by cellular_hal_get_current_modem_interface_status(). */
+    CellularSignalInfoStruct SignalInfo;         /**!< Same value as returned by cellular_hal_get_signal_info(). */
+    CellularCurrentPlmnInfoStruct PlmnInfo;      /**!< Same value as returned by cellular_hal_get_current_plmn_information(). */
+    CellLocationInfoStruct CellLocationInfo;     /**!< Same value as returned by cellular_hal_get_cell_location_info(). */
+    CellularPacketStatsStruct PacketStats;       /**!< Same value as returned by cellular_hal_get_packet_statistics(). */
+} CellularTelemetrySnapshotStruct;
+
+#define CELLULAR_SIGNAL_MAX_THRESHOLDS            (4)           //!< Maximum number of thresholds per signal metric
+
+/**! Represents the signal metrics reported in CellularSignalInfoStruct. */
+typedef enum _CellularSignalMetric_t {
+    CELLULAR_SIGNAL_METRIC_RSSI = 0,   /**!< CellularSignalInfoStruct::RSSI. */
+    CELLULAR_SIGNAL_METRIC_RSRQ,       /**!< CellularSignalInfoStruct::RSRQ. */
+    CELLULAR_SIGNAL_METRIC_RSRP,       /**!< CellularSignalInfoStruct::RSRP. */
+    CELLULAR_SIGNAL_METRIC_SNR,        /**!< CellularSignalInfoStruct::SNR. */
+    CELLULAR_SIGNAL_METRIC_TXPOWER,    /**!< CellularSignalInfoStruct::TXPower. */
+    CELLULAR_SIGNAL_METRIC_MAX         /**!< Number of signal metrics. */
+} CellularSignalMetric_t;
+
+/**! Represents the reporting criteria of a single signal metric. */
+typedef struct
+{
+    unsigned char Enable;                           /**!< Whether changes of this metric are reported (1) or ignored (0). */
+    unsigned int ThresholdCount;                    /**!< Number of valid entries in Thresholds. The possible range is 0 to CELLULAR_SIGNAL_MAX_THRESHOLDS. */
+    int Thresholds[CELLULAR_SIGNAL_MAX_THRESHOLDS]; /**!< Threshold levels in the unit of the metric (dBm or dB). A report is
+                                                         generated when the metric crosses one of them. */
+    unsigned int Hysteresis;                        /**!< Distance the metric must move back past a threshold before crossing it again
+                                                         is reported, in the unit of the metric. 0 disables hysteresis. */
+} CellularSignalThresholdStruct;
+
+/**! Represents the configuration of the signal quality monitor. */
+typedef struct
+{
+    CellularSignalThresholdStruct Metric[CELLULAR_SIGNAL_METRIC_MAX]; /**!< Reporting criteria, indexed by CellularSignalMetric_t. */
+    unsigned int MinReportIntervalMs;                                /**!< Minimum time between two reports, in milliseconds.
+                                                                          Crossings inside this window are merged into one report. */
+} CellularSignalMonitorConfigStruct;
+
+#define CELLULAR_SIGNAL_HISTORY_DEPTH_1SEC        (300)         //!< Number of 1 second buckets retained (5 minutes)
+#define CELLULAR_SIGNAL_HISTORY_DEPTH_1MIN        (60)          //!< Number of 1 minute buckets retained (1 hour)
+#define CELLULAR_SIGNAL_HISTORY_DEPTH_15MIN       (96)          //!< Number of 15 minute buckets retained (24 hours)
+#define CELLULAR_SIGNAL_HISTORY_SHM_NAME          "/cellular_hal_signal_history"  //!< POSIX shared memory object holding the signal history
+
+/**! Represents the resolution of the signal history. */
+typedef enum _CellularSignalHistoryResolution_t {
+    CELLULAR_SIGNAL_HISTORY_1SEC = 1,   /**!< 1 second buckets. */
+    CELLULAR_SIGNAL_HISTORY_1MIN,       /**!< 1 minute buckets. */
+    CELLULAR_SIGNAL_HISTORY_15MIN       /**!< 15 minute buckets. */
+} CellularSignalHistoryResolution_t;
+
+/**! Represents the aggregate of one signal metric over a history bucket. */
+typedef struct
+{
+    int Min;    /**!< Minimum value in the bucket, in the unit of the metric. */
+    int Max;    /**!< Maximum value in the bucket, in the unit of the metric. */
+    int Mean;   /**!< Mean value in the bucket, in the unit of the metric. */
+} CellularSignalAggregateStruct;
+
+/**! Represents one bucket of the signal history. */
+typedef struct
+{
+    uint64_t Timestamp;                                           /**!< Start of the bucket, in milliseconds of CLOCK_MONOTONIC. */
+    unsigned int SampleCount;                                     /**!< Number of samples aggregated in the bucket. 0 if the signal was not available. */
+    CellularSignalAggregateStruct Metric[CELLULAR_SIGNAL_METRIC_MAX]; /**!< Aggregates, indexed by CellularSignalMetric_t. */
+} CellularSignalHistoryBucketStruct;
+
+#define CELLULAR_SHARED_STATE_SHM_NAME    "/cellular_hal_state"  //!< POSIX shared memory object holding CellularSharedStatePageStruct
+#define CELLULAR_SHARED_STATE_MAGIC       (0x43454C4CU)          //!< Magic value of an initialised shared state page ("CELL")
+#define CELLULAR_SHARED_STATE_VERSION     (1)                    //!< Layout version of CellularSharedStatePageStruct
+#define CELLULAR_SHARED_STATE_READ_RETRIES (1000)                //!< Maximum number of seqlock retries of one shared state read
+
+/**! Represents the modem state published by the HAL for readers in other processes. */
+typedef struct
+{
+    uint64_t Timestamp;                                      /**!< Time of the last update, in milliseconds of CLOCK_MONOTONIC. */
+    CellularInterfaceStatus_t InterfaceStatus;               /**!< Current modem interface status. */
+    CellularDeviceNASStatus_t RegistrationStatus;            /**!< Current NAS registration status. */
+    CellularDeviceNASRoamingStatus_t RoamingStatus;          /**!< Current NAS roaming status. */
+    CellularModemRegisteredServiceType_t RegisteredService;  /**!< Current registered service type. */
+    CellularCurrentPlmnInfoStruct PlmnInfo;                  /**!< Current PLMN information. */
+    CellularSignalInfoStruct SignalInfo;                     /**!< Last known signal information. */
+    CellularIPStruct IPv4Info;                               /**!< IPv4 configuration. IPType is CELLULAR_NETWORK_IP_FAMILY_UNKNOWN when not configured. */
+    CellularIPStruct IPv6Info;                               /**!< IPv6 configuration. IPType is CELLULAR_NETWORK_IP_FAMILY_UNKNOWN when not configured. */
+    CellularPacketStats64Struct PacketStats;                 /**!< Last sampled packet statistics. Only the totals and Timestamp are valid;
+                                                                  the delta, rate and IntervalMs fields are 0, because deltas are relative
+                                                                  to the previous sample of each caller. */
+    char Imei[16];                                           /**!< Modem IMEI. The string is zero-terminated and the terminator is included in the size. */
+    char ImeiSv[16];                                         /**!< Modem IMEI software version. The string is zero-terminated and the terminator is included in the size. */
+    char Iccid[21];                                          /**!< Current ICCID. The string is zero-terminated and the terminator is included in the size. */
+    char Msisdn[20];                                         /**!< Current MSISDN. The string is zero-terminated and the terminator is included in the size. */
+    char FirmwareVersion[128];                               /**!< Modem firmware version. The string is zero-terminated and the terminator is included in the size. */
+} CellularSharedStateStruct;
+
+/**!
+ * @brief Represents the layout of the shared state page.
+ *
+ * The page is written only by the process which opened the device and is mapped read-only by every other process.
+ * Sequence implements a seqlock and is only accessed with atomic operations (C11 atomics or the __atomic builtins),
+ * because volatile alone gives no ordering against the plain copy of State on weakly ordered CPUs such as ARM.
+ * Writer:
+ *   1. seq = Sequence + 1 (odd); __atomic_store_n(&Sequence, seq, __ATOMIC_RELAXED); __atomic_thread_fence(__ATOMIC_RELEASE);
+ *   2. update State;
+ *   3. __atomic_store_n(&Sequence, seq + 1, __ATOMIC_RELEASE).
+ * Reader:
+ *   1. s1 = __atomic_load_n(&Sequence, __ATOMIC_ACQUIRE); retry while s1 is odd;
+ *   2. copy State;
+ *   3. __atomic_thread_fence(__ATOMIC_ACQUIRE); s2 = __atomic_load_n(&Sequence, __ATOMIC_RELAXED); retry from 1 if s2 != s1.
+ * A reader gives up after CELLULAR_SHARED_STATE_READ_RETRIES retries, so a writer which died during an update cannot make
+ * it spin forever. The next writer which opens the device and finds Sequence odd rewrites State and makes Sequence even.
+ */
+typedef struct
+{
+    uint32_t Magic;                    /**!< CELLULAR_SHARED_STATE_MAGIC once the page is initialised. */
+    uint32_t Version;                  /**!< CELLULAR_SHARED_STATE_VERSION of the writer. */
+    uint32_t Size;                     /**!< Size of the whole page structure in bytes. */
+    uint32_t Sequence;                 /**!< Seqlock sequence counter. Odd while an update is in progress. Only accessed atomically. */
+    CellularSharedStateStruct State;   /**!< Published modem state. */
+} CellularSharedStatePageStruct;
+
+/**! Represents the counters of the identity and capability cache. */
+typedef struct
+{
+    uint64_t Hits;            /**!< Identity reads served from the cache. */
+    uint64_t Misses;          /**!< Identity reads which required a modem query. */
+    uint64_t Invalidations;   /**!< Number of times the cache was invalidated. */
+} CellularIdentityCacheStatsStruct;
+
+#define CELLULAR_ASYNC_REQUEST_ID_INVALID         (0)           //!< Request ID never assigned to an asynchronous request
+
+/**! Represents the operation carried out by an asynchronous request. */
+typedef enum _CellularAsyncOperation_t {
+    CELLULAR_ASYNC_OP_INIT = 1,                 /**!< cellular_hal_init_async(). */
+    CELLULAR_ASYNC_OP_START_NETWORK,            /**!< cellular_hal_start_network_async(). */
+    CELLULAR_ASYNC_OP_NETWORK_ATTACH,           /**!< cellular_hal_set_modem_network_attach_async(). */
+    CELLULAR_ASYNC_OP_AVAILABLE_NETWORKS        /**!< cellular_hal_get_available_networks_information_async(). */
+} CellularAsyncOperation_t;
+
+/**! Represents the completion of an asynchronous request. */
+typedef struct
+{
+    unsigned int RequestId;                                 /**!< Request ID returned when the request was submitted. */
+    CellularAsyncOperation_t Operation;                     /**!< Operation which completed. */
+    int Status;                                             /**!< Result of the operation, as the synchronous API would have returned it. */
+    CellularNetworkScanResultInfoStruct *pNetworkInfo;      /**!< Only for CELLULAR_ASYNC_OP_AVAILABLE_NETWORKS, otherwise NULL.
+                                                                 The array is allocated by the HAL and must be released by the caller with free(). */
+    unsigned int NetworkCount;                              /**!< Only for CELLULAR_ASYNC_OP_AVAILABLE_NETWORKS, number of entries in pNetworkInfo. */
+} CellularAsyncCompletionStruct;
+
+#define CELLULAR_API_LATENCY_BUCKETS              (32)          //!< Number of buckets of CellularApiStatsStruct::LatencyHistogram
+
+/**!
+ * @brief Represents the call statistics of one cellular_hal_* API.
+ *
+ * LatencyHistogram is log2 bucketed: bucket 0 counts calls faster than 1 microsecond, bucket i (i > 0) counts calls
+ * taking from 2^(i-1) up to 2^i microseconds and the last bucket also counts every slower call.
+ * Percentiles are derived by the caller by accumulating buckets up to the requested fraction of Calls.
+ */
+typedef struct
+{
+    char ApiName[64];                                      /**!< Name of the API, e.g. "cellular_hal_get_signal_info".
+                                                                The string is zero-terminated and the terminator is included in the size. */
+    uint64_t Calls;                                        /**!< Number of completed calls. */
+    uint64_t Errors;                                       /**!< Number of calls which returned RETURN_ERR. */
+    uint64_t Timeouts;                                     /**!< Number of calls which returned RETURN_TIMEOUT. */
+    uint64_t Cancellations;                                /**!< Number of calls which returned RETURN_CANCELLED. */
+    uint64_t TotalLatencyUs;                               /**!< Sum of the latency of all calls, in microseconds. */
+    uint64_t MaxLatencyUs;                                 /**!< Latency of the slowest call, in microseconds. */
+    uint64_t LatencyHistogram[CELLULAR_API_LATENCY_BUCKETS]; /**!< Number of calls per latency bucket. */
+} CellularApiStatsStruct;
+
+/**! Represents the timing of one phase of a multi-phase operation. */
+typedef struct
+{
+    uint32_t StartMs;      /**!< Start of the phase, in milliseconds since the start of the operation. */
+    uint32_t DurationMs;   /**!< Duration of the phase in milliseconds. 0 if the phase was skipped. */
+} CellularPhaseTimingStruct;
+
+/**! Represents the per phase timing of a UICC slot switch. */
+typedef struct
+{
+    unsigned char Prewarmed;                  /**!< Whether the target slot was kept ready as standby slot (1) or not (0). */
+    CellularPhaseTimingStruct SimPower;       /**!< Powering the UICC of the target slot. Skipped for a prewarmed slot. */
+    CellularPhaseTimingStruct SlotSelect;     /**!< Switching the active slot. */
+    CellularPhaseTimingStruct SimReady;       /**!< Waiting for the UICC application and profile to be ready. Skipped for a prewarmed slot. */
+    CellularPhaseTimingStruct Registration;   /**!< Network registration with the new subscription. */
+    uint32_t TotalMs;                         /**!< Duration of the whole switch in milliseconds. */
+} CellularSlotSwitchTimingStruct;
+
+/**! Represents the state of a connect transaction. */
+typedef enum _CellularConnectState_t {
+    CELLULAR_CONNECT_STATE_IN_PROGRESS = 1,   /**!< The transaction is still running. */
+    CELLULAR_CONNECT_STATE_COMPLETED,         /**!< IP ready was reached. */
+    CELLULAR_CONNECT_STATE_FAILED,            /**!< A phase failed or the deadline expired, see FailedPhase and FailureStatus. */
+    CELLULAR_CONNECT_STATE_CANCELLED          /**!< The transaction was cancelled with cellular_hal_cancel_connect() or cellular_hal_deinit(). */
+} CellularConnectState_t;
+
+/**! Represents a phase of a connect transaction. */
+typedef enum _CellularConnectPhase_t {
+    CELLULAR_CONNECT_PHASE_NONE = 0,          /**!< No phase. */
+    CELLULAR_CONNECT_PHASE_PROFILE_SETUP,     /**!< Creating or selecting the profile. */
+    CELLULAR_CONNECT_PHASE_ATTACH,            /**!< Network attach request. */
+    CELLULAR_CONNECT_PHASE_REGISTRATION,      /**!< Network registration. */
+    CELLULAR_CONNECT_PHASE_DATA_SESSION,      /**!< Data session setup. */
+    CELLULAR_CONNECT_PHASE_IP_READY           /**!< IP configuration. */
+} CellularConnectPhase_t;
+
+/**!
+ * @brief Represents the state and per phase timing of a connect transaction.
+ *
+ * Phases may overlap, so the sum of the phase durations can be larger than TotalMs.
+ */
+typedef struct
+{
+    CellularConnectState_t State;             /**!< State of the transaction. */
+    CellularConnectPhase_t FailedPhase;       /**!< Phase which failed or was running when the transaction was cancelled.
+                                                   CELLULAR_CONNECT_PHASE_NONE unless State is FAILED or CANCELLED. */
+    int FailureStatus;                        /**!< RETURN_ERR if a phase failed, RETURN_TIMEOUT if the deadline expired, RETURN_CANCELLED if
+                                                   State is CANCELLED. RETURN_OK otherwise. */
+    unsigned char FromStandby;                /**!< Whether the transaction was a cellular_hal_activate_backup() from hot standby (1) or a
+                                                   cellular_hal_connect() (0). Phases already done in standby are reported as skipped. */
+    CellularPhaseTimingStruct ProfileSetup;   /**!< Creating or selecting the profile until DEVICE_PROFILE_STATUS_READY. */
+    CellularPhaseTimingStruct Attach;         /**!< Network attach request. */
+    CellularPhaseTimingStruct Registration;   /**!< Waiting for DEVICE_NAS_STATUS_REGISTERED. */
+    CellularPhaseTimingStruct DataSession;    /**!< Data session setup until DEVICE_NETWORK_STATUS_CONNECTED. */
+    CellularPhaseTimingStruct IPReady;        /**!< IP configuration until DEVICE_NETWORK_IP_READY. */
+    uint32_t TotalMs;                         /**!< Time from the start of the transaction to IP ready, or to the failure, in milliseconds. */
+} CellularConnectTimingStruct;
+
+#define CELLULAR_EVENT_JOURNAL_SIZE               (256)         //!< Number of events retained by the event journal
+
+/**! Represents the type of a state event recorded in the event journal. */
+typedef enum _CellularEventType_t {
+    CELLULAR_EVENT_DEVICE_OPEN_STATUS = 1,   /**!< Same information as cellular_device_open_status_api_callback. */
+    CELLULAR_EVENT_DEVICE_REMOVED_STATUS,    /**!< Same information as cellular_device_removed_status_api_callback. */
+    CELLULAR_EVENT_SLOT_STATUS,              /**!< Same information as cellular_device_slot_status_api_callback. */
+    CELLULAR_EVENT_REGISTRATION_STATUS,      /**!< Same information as cellular_device_registration_status_callback. */
+    CELLULAR_EVENT_PROFILE_STATUS,           /**!< Same information as cellular_device_profile_status_api_callback. */
+    CELLULAR_EVENT_PACKET_SERVICE_STATUS,    /**!< Same information as cellular_network_packet_service_status_api_callback. */
+    CELLULAR_EVENT_IP_READY_STATUS           /**!< Same information as cellular_device_network_ip_ready_api_callback. */
+} CellularEventType_t;
+
+/**! Represents a state event recorded in the event journal. */
+typedef struct
+{
+    uint64_t Sequence;               /**!< Sequence number of the event. Starts at 1 and increases by one for every recorded event. */
+    uint64_t Timestamp;              /**!< Time of the event, in milliseconds of CLOCK_MONOTONIC. */
+    CellularEventType_t EventType;   /**!< Type of the event, selects the valid member of Event. */
+    union
+    {
+        struct
+        {
+            CellularDeviceOpenStatus_t Status;                      /**!< Device open status. */
+            CellularModemOperatingConfiguration_t OperatingMode;    /**!< Modem operating mode. */
+        } DeviceOpen;                                               /**!< Valid for CELLULAR_EVENT_DEVICE_OPEN_STATUS. */
+        struct
+        {
+            CellularDeviceDetectionStatus_t Status;                 /**!< Device detection status. */
+        } DeviceRemoved;                                            /**!< Valid for CELLULAR_EVENT_DEVICE_REMOVED_STATUS. */
+        struct
+        {
+            int SlotNum;                                            /**!< Slot number. */
+            CellularDeviceSlotStatus_t Status;                      /**!< Slot status. */
+        } Slot;                                                     /**!< Valid for CELLULAR_EVENT_SLOT_STATUS. */
+        struct
+        {
+            CellularDeviceNASStatus_t Status;                       /**!< NAS registration status. */
+            CellularDeviceNASRoamingStatus_t RoamingStatus;         /**!< NAS roaming status. */
+            CellularModemRegisteredServiceType_t RegisteredService; /**!< Registered service type. */
+        } Registration;                                             /**!< Valid for CELLULAR_EVENT_REGISTRATION_STATUS. */
+        struct
+        {
+            char ProfileID[64];                                     /**!< Profile ID. The string is zero-terminated and the terminator is included in the size. */
+            CellularPDPType_t PDPType;                              /**!< PDP type. */
+            CellularDeviceProfileSelectionStatus_t Status;          /**!< Profile status. */
+        } Profile;                                                  /**!< Valid for CELLULAR_EVENT_PROFILE_STATUS. */
+        struct
+        {
+            CellularNetworkIPType_t IPType;                         /**!< IP family of the packet service. */
+            CellularNetworkPacketStatus_t Status;                   /**!< Packet service status. */
+        } PacketService;                                            /**!< Valid for CELLULAR_EVENT_PACKET_SERVICE_STATUS. */
+        struct
+        {
+            CellularNetworkIPType_t IPType;                         /**!< IP family of the configuration. */
+            CellularDeviceIPReadyStatus_t Status;                   /**!< IP ready status. */
+        } IPReady;                                                  /**!< Valid for CELLULAR_EVENT_IP_READY_STATUS. */
+    } Event;                                                        /**!< Event specific information. */
+} CellularEventStruct;
+
+#define CELLULAR_CALLBACK_QUEUE_SIZE_DEFAULT      (64)          //!< Default capacity of the callback dispatch queue
+
+/**! Represents the configuration of the callback dispatch queue. */
+typedef struct
+{
+    unsigned int QueueSize;      /**!< Capacity of the queue in report events. 0 selects CELLULAR_CALLBACK_QUEUE_SIZE_DEFAULT.
+                                      The reserved state event entries are allocated in addition to QueueSize, so every value from 1 up is valid. */
+    unsigned char Coalesce;      /**!< Whether a queued status event is replaced by a newer event of the same type (1) or kept (0).
+                                      Coalescing is enabled (1) until cellular_hal_set_callback_dispatch_config() is called. */
+} CellularCallbackDispatchConfigStruct;
+
+/**! Represents the counters of the callback dispatch queue. */
+typedef struct
+{
+    uint64_t Enqueued;           /**!< Events posted to the queue by the HAL internal threads. */
+    uint64_t Dispatched;         /**!< Events delivered to the registered callbacks. */
+    uint64_t Coalesced;          /**!< Events replaced by a newer event of the same type before being delivered. */
+    uint64_t Dropped;            /**!< Report events (signal reports, scan results) discarded because the queue was full. */
+    unsigned int QueueDepth;     /**!< Number of events currently queued. */
+    unsigned int MaxQueueDepth;  /**!< Highest number of events queued at the same time. */
+} CellularCallbackDispatchStatsStruct;
+
 /** @} */  //END OF GROUP CELLULAR_HAL_TYPES
 /**
  * @addtogroup CELLULAR_HAL_APIS
@@ -447,6 +874,15 @@ typedef enum _CellularNetworkPacketStatus_t
  *
  */
 
+/*
+ * Deadlines and cancellation:
+ *
+ * In addition to the @retval values listed for each API, every cellular_hal_* API returning int can return
+ *   - RETURN_TIMEOUT   if the deadline set with cellular_hal_set_call_timeout() by the calling thread expired,
+ *   - RETURN_CANCELLED if the call was cancelled with cellular_hal_cancel_call() or cellular_hal_deinit().
+ * The exceptions are cellular_hal_set_call_timeout(), cellular_hal_get_call_timeout() and the cancellation APIs themselves.
+ */
+
 /**
 * @brief - Returns Modem Device Available Status
 *
@@ -460,6 +896,10 @@ unsigned int cellular_hal_IsModemDevicePresent(void);
 /**
 * @brief - Initialise the Cellular HAL
 *
+* If a data session was kept by cellular_hal_deinit(), this API does not reset the modem, change its operating mode, switch the
+* slot or tear the session and its IP configuration down. The session stays up until it is re-adopted by cellular_hal_resume()
+* or stopped by cellular_hal_stop_network().
+*
 * @param[in] pstCtxInputStruct variable is the Input structure to pass to cellular hal initialization function described by the CellularContextInitInputStruct.
 *
 * @return The status of the operation
@@ -469,6 +909,24 @@ unsigned int cellular_hal_IsModemDevicePresent(void);
 */
 int cellular_hal_init(CellularContextInitInputStruct *pstCtxInputStruct);
 
+/**
+* @brief - Deinitialise the Cellular HAL
+*
+* Releases every resource acquired since cellular_hal_init(): internal threads, modem control interfaces, shared memory and callbacks.
+* No callback is invoked after this API returns.
+*
+* @param[in] keep_data_session variable is a unsigned character.
+*                              \n If 1 then the default data session and its IP configuration are left up in the modem, so that it can be
+*                              \n re-adopted by cellular_hal_resume() after a restart of the caller. If 0 then the default data session is stopped.
+*                              \n Sessions started with cellular_hal_start_network_session() are always stopped, and their handles become invalid.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_deinit(unsigned char keep_data_session);
+
 /**
 * @brief - This callback sends to upper layer when after successfully open cellular device context.
 *
@@ -595,6 +1053,50 @@ int cellular_hal_select_device_slot(cellular_device_slot_status_api_callback dev
 */
 int cellular_hal_sim_power_enable(unsigned int slot_id, unsigned char enable);
 
+/**
+* @brief - This API inform lower layer to keep a non active slot ready as standby slot
+*
+* The UICC of the standby slot stays powered, its application is initialised and its ICCID and profile are validated in advance,
+* so that cellular_hal_switch_slot() only has to switch the active subscription. Only one standby slot can be configured.
+*
+* @param[in] slot_id variable is a unsigned integer holding the standby slot id.
+*                    \n The possible values can be 1 or 2 and depends on number of SIM slots provided by vendor.
+* @param[in] enable variable is a unsigned character to enable (1) or disable (0) standby for the slot.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected or the slot is the active slot
+*
+*/
+int cellular_hal_set_standby_slot(unsigned int slot_id, unsigned char enable);
+
+/**
+* @brief - This API switch the active subscription to another slot in a single operation
+*
+* Replaces the sequence cellular_hal_sim_power_enable(), cellular_hal_select_device_slot() and waiting for registration.
+* Returns when the device is registered on the new subscription, the deadline of the calling thread expires or an error is detected.
+* Phases which are already done for a standby slot are skipped.
+*
+* The data sessions of the old subscription, the default session and the sessions started with cellular_hal_start_network_session(),
+* are stopped before the switch. For each of them device_network_ip_ready_cb reports DEVICE_NETWORK_IP_NOT_READY and then
+* packet_service_status_cb reports DEVICE_NETWORK_STATUS_DISCONNECTED, through the callbacks registered for that session, and the
+* handles of the additional sessions become invalid. Hot standby set with cellular_hal_set_backup_standby() is left as well.
+* No session is started on the new subscription; the caller starts them again, e.g. with cellular_hal_connect().
+* The old active slot stays powered and becomes the standby slot, replacing any other standby slot, so that switching back is fast.
+*
+* @param[in] slot_id variable is a unsigned integer holding the target slot id.
+*                    \n The possible values can be 1 or 2 and depends on number of SIM slots provided by vendor.
+* @param[in] device_slot_status_cb variable is the function pointer which receives device slot status response from driver.
+* @param[out] pstTiming is a pointer to structure CellularSlotSwitchTimingStruct filled with the per phase timing. Can be NULL.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_TIMEOUT if the deadline of the calling thread expired
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_switch_slot(unsigned int slot_id, cellular_device_slot_status_api_callback device_slot_status_cb, CellularSlotSwitchTimingStruct *pstTiming);
+
 /**
 * @brief - This API get UICC total slots count from modem
 *
@@ -729,6 +1231,42 @@ int cellular_hal_profile_modify(CellularProfileStruct *pstProfileInput, cellular
 */
 int cellular_hal_get_profile_list(CellularProfileStruct **ppstProfileOutput, int *profile_count);
 
+/**
+* @brief - This API get list of profiles into a caller allocated buffer without any allocation in the HAL
+*
+* Profiles are served from the index kept by the lower layer, which is updated on create/modify/delete.
+*
+* @param[out] pstProfileOutput is a caller allocated array of CellularProfileStruct that needs to be updated.
+*                              \n If NULL then only profile_count is returned.
+* @param[in] max_count variable is a unsigned integer holding the number of entries of pstProfileOutput.
+* @param[out] profile_count variable is a unsigned integer pointer filled with the total number of profiles.
+*                           \n When it is greater than max_count only the first max_count profiles are written.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_profile_list_buffer(CellularProfileStruct *pstProfileOutput, unsigned int max_count, unsigned int *profile_count);
+
+/**
+* @brief - This API find a profile by ID or APN in the profile index kept by the lower layer
+*
+* ProfileID is unique, but several profiles can share an APN, e.g. with different PDP types.
+* When several profiles match an APN, the default profile is returned if it is one of them, otherwise the one with the lowest ProfileID.
+*
+* @param[in] pstProfileKey is a pointer to structure CellularProfileKeyStruct holding the lookup key.
+* @param[out] pstProfileOutput is a pointer to structure CellularProfileStruct that needs to be updated.
+* @param[out] match_count variable is a unsigned integer pointer filled with the number of profiles matching the key. Can be NULL.
+*                         \n A value greater than 1 tells the caller the lookup was ambiguous.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected or no profile matches the key
+*
+*/
+int cellular_hal_profile_find(CellularProfileKeyStruct *pstProfileKey, CellularProfileStruct *pstProfileOutput, unsigned int *match_count);
+
 /**
 * @brief - This callback sends to upper layer when after getting packet service status after start network.
 *
@@ -760,6 +1298,38 @@ typedef int (*cellular_network_packet_service_status_api_callback)( char *device
 */
 typedef int (*cellular_device_network_ip_ready_api_callback)( CellularIPStruct *pstIPStruct, CellularDeviceIPReadyStatus_t ip_ready_status );
 
+/**
+* @brief - This callback sends the complete dual-stack IP configuration to upper layer in binary form
+*
+* It is invoked once per change of the IP configuration, covering both IP families, so the caller does not have to merge
+* separate IPv4 and IPv6 device_network_ip_ready_cb invocations.
+*
+* @param[in] pstIPConfig variable is a structure pointer from CellularIPConfigStruct. Only valid for the duration of the callback.
+* @param[in] ip_ready_status variable is from the enumerated datatype CellularDeviceIPReadyStatus_t.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+typedef int (*cellular_device_network_ip_config_api_callback)( CellularIPConfigStruct *pstIPConfig, CellularDeviceIPReadyStatus_t ip_ready_status );
+
+/**
+* @brief - This API register the callback which receives the dual-stack IP configuration in binary form
+*
+* The callback is invoked in addition to device_network_ip_ready_cb of CellularNetworkCBStruct, for every data session.
+* CellularIPConfigStruct::WANIFName identifies the session. A later call replaces the previous registration.
+*
+* @param[in] device_network_ip_config_cb is a function pointer from cellular_device_network_ip_config_api_callback.
+*                                        \n If NULL then the callback is unregistered.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_register_ip_config_cb( cellular_device_network_ip_config_api_callback device_network_ip_config_cb );
+
 typedef  struct
 {
     cellular_device_network_ip_ready_api_callback device_network_ip_ready_cb;        /**< To get IP configuration from driver.
@@ -791,235 +1361,650 @@ typedef  struct
 int cellular_hal_start_network( CellularNetworkIPType_t ip_request_type, CellularProfileStruct *pstProfileInput, CellularNetworkCBStruct *pstCBStruct );
 
 /**
-* @brief - This API inform lower layer to stop network based on valid ip request type.
+* @brief - This API enable or disable applying the IP configuration to the WAN interface inside the HAL
+*
+* When enabled, the HAL programs the address, MTU and link state of WANIFName with one batched rtnetlink message sequence
+* before reporting DEVICE_NETWORK_IP_READY, and removes them again on DEVICE_NETWORK_IP_NOT_READY.
+* The default route is only programmed for the default session, started by cellular_hal_start_network(), cellular_hal_connect() or
+* cellular_hal_activate_backup(). Sessions started with cellular_hal_start_network_session() get their address, MTU and link state
+* but never the default route, so e.g. a management APN cannot take it over.
+* The result is reported in CellularIPConfigStruct::ApplyStatus of the callback registered with cellular_hal_register_ip_config_cb().
+* If applying fails, device_network_ip_ready_cb reports DEVICE_NETWORK_IP_NOT_READY instead of DEVICE_NETWORK_IP_READY,
+* so callers which only use that callback never consider the interface ready.
+* DNS configuration stays with the caller. Disabled by default.
 *
+* @param[in] enable variable is a unsigned character to enable (1) or disable (0) applying the IP configuration.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
 *
 */
-int cellular_hal_stop_network(CellularNetworkIPType_t ip_request_type);
+int cellular_hal_set_ip_config_apply( unsigned char enable );
 
 /**
-* @brief - This API get current signal information from Modem
+* @brief - This API inform lower layer to stop network based on valid ip request type.
 *
-* @param[out] signal_info variable is a pointer, needs to parse CellularSignalInfoStruct structure to get signal information.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
 *
 */
-int cellular_hal_get_signal_info(CellularSignalInfoStruct *signal_info);
+int cellular_hal_stop_network(CellularNetworkIPType_t ip_request_type);
 
 /**
-* @brief - This API gets cell location information. 
+* @brief - This callback sends the final state of a connect transaction to upper layer
+*
+* Invoked once per transaction, when State leaves CELLULAR_CONNECT_STATE_IN_PROGRESS.
+*
+* @param[in] pstTiming variable is a structure pointer from CellularConnectTimingStruct holding the state, the failed phase and the per phase timing.
 *
-* @param[out] loc_info variable is a pointer, needs to parse CellLocationInfoStruct structure to get location information.                          
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
+*
 */
-int cellular_hal_get_cell_location_info(CellLocationInfoStruct *loc_info);
+typedef int (*cellular_connect_status_api_callback)( CellularConnectTimingStruct *pstTiming );
 
 /**
-* @brief - This API inform lower layer to configure modem operating mode.
-* @param[in] modem_operating_config variable is from the enumerated datatype needs to pass CellularModemOperatingConfiguration_t to configure modem state.
+* @brief - This API inform lower layer to bring up the cellular WAN in a single connect transaction
+*
+* Replaces the serial sequence cellular_hal_profile_create(), cellular_hal_set_modem_network_attach(), waiting for registration
+* and cellular_hal_start_network(). The lower layer overlaps independent steps, e.g. profile setup with attach and registration,
+* and starts the default data session as soon as both are done. Returns once the transaction is started; packet and IP status are
+* reported through the callbacks of pstCBStruct and the end of the transaction, successful or not, through connect_status_cb.
+*
+* The whole transaction is bounded by the deadline set with cellular_hal_set_call_timeout() by the calling thread, measured from
+* this call. When it expires the transaction ends with State CELLULAR_CONNECT_STATE_FAILED and FailureStatus RETURN_TIMEOUT.
+* Without a deadline each phase is only bounded by the timeouts of the modem. The transaction can be cancelled with
+* cellular_hal_cancel_connect().
+*
+* @param[in] pstCtxInputStruct variable is the Input structure described by the CellularContextInitInputStruct holding the IP family preference,
+*                              \n profile and preferred access technology of the connection.
+* @param[in] pstCBStruct - Here needs to fill CB function pointer for packet and ip status from the structure CellularNetworkCBStruct.
+* @param[in] connect_status_cb is a function pointer which receives the final state of the transaction. Can be NULL.
 *
 * @return The status of the operation
-* @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_OK if the transaction is started
+* @retval RETURN_ERR if any error is detected or a connect transaction is already in progress
 *
 */
-int cellular_hal_set_modem_operating_configuration(CellularModemOperatingConfiguration_t modem_operating_config);
+int cellular_hal_connect( CellularContextInitInputStruct *pstCtxInputStruct, CellularNetworkCBStruct *pstCBStruct, cellular_connect_status_api_callback connect_status_cb );
 
 /**
-* @brief - Returns Modem Device IMEI information
+* @brief - This API get the per phase timing of the most recent connect transaction
 *
-* @param[out] imei variable is a character pointer, needs to return Modem IMEI value on this input.
-*                  \n The buffer size should be atleast 16 bytes long. Example: "010928/00/389023/36".
+* @param[out] pstTiming is a pointer to structure CellularConnectTimingStruct that needs to be updated.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_ERR if any error is detected or no connect transaction was started
 *
 */
-int cellular_hal_get_device_imei ( char *imei );
+int cellular_hal_get_connect_timing( CellularConnectTimingStruct *pstTiming );
 
 /**
-* @brief - Returns Modem Device IMEI Software Version
+* @brief - This API cancel the connect transaction in progress
 *
-* @param[out] imei_sv variable is a character pointer, needs to return Modem IMEI Software Version value on this input.
-*                     \n The buffer size should be atleast 16 bytes long. Example: 36.
+* The modem is left in a consistent state and the transaction ends with State CELLULAR_CONNECT_STATE_CANCELLED,
+* FailureStatus RETURN_CANCELLED and FailedPhase set to the phase which was running. cellular_hal_deinit() cancels
+* a transaction in progress the same way.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_ERR if any error is detected or no connect transaction is in progress
 *
 */
-int cellular_hal_get_device_imei_sv ( char *imei_sv );
+int cellular_hal_cancel_connect( void );
 
 /**
-* @brief - Returns Modem Device Current ICCID Information
+* @brief - This API inform lower layer to enter or leave hot standby for backup WAN use
 *
-* @param[out] iccid variable is a character pointer, needs to return currently choosed ICCID value on this input.
-*                   \n The buffer size should be atleast 21 bytes long. Example: "8901260410032962638F".
+* In hot standby the modem is kept online, registered and packet-switched attached, and the PDN context of the profile is
+* defined and authorised but no bearer is active. cellular_hal_activate_backup() then only has to bring up the bearer and IP.
+*
+* @param[in] enable variable is a unsigned character to enter (1) or leave (0) hot standby.
+* @param[in] pstCtxInputStruct variable is the Input structure described by the CellularContextInitInputStruct holding the IP family preference,
+*                              \n profile and preferred access technology to prepare. Ignored when enable is 0.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_ERR if any error is detected or a data session is already active
 *
 */
-int cellular_hal_get_modem_current_iccid ( char *iccid );
+int cellular_hal_set_backup_standby( unsigned char enable, CellularContextInitInputStruct *pstCtxInputStruct );
 
 /**
-* @brief - Returns Modem Device Current MSISDN Information
+* @brief - This API inform lower layer to activate the dormant data session prepared by cellular_hal_set_backup_standby()
 *
-* @param[out] msisdn variable is a character pointer, needs to return currently choosed MSISDN value on this input.
-*                    \n The buffer size should be atleast 20 bytes long. Example: "9386720110".
+* Returns once activation is started; progress is reported through the callbacks of pstCBStruct. The activation is a connect
+* transaction with FromStandby set: its end, successful or not, and the time from this call to device_network_ip_ready_cb are
+* reported through connect_status_cb and cellular_hal_get_connect_timing(). It is bounded and cancelled like cellular_hal_connect().
+*
+* @param[in] pstCBStruct - Here needs to fill CB function pointer for packet and ip status from the structure CellularNetworkCBStruct.
+* @param[in] connect_status_cb is a function pointer which receives the final state of the activation. Can be NULL.
 *
 * @return The status of the operation
-* @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_OK if activation is started
+* @retval RETURN_ERR if any error is detected or the modem is not in hot standby
 *
 */
-int cellular_hal_get_modem_current_msisdn ( char *msisdn );
+int cellular_hal_activate_backup( CellularNetworkCBStruct *pstCBStruct, cellular_connect_status_api_callback connect_status_cb );
 
 /**
-* @brief - This API get current network packet statistics from modem
+* @brief - This API inform lower layer to start an additional packet data session on its own PDN context
 *
-* @param[out] network_packet_stats variable is a pointer, needs to parse CellularPacketStatsStruct structure to get packet statistics information.
+* Up to CELLULAR_MAX_DATA_SESSIONS sessions in total, including the default session, each on a different profile, can be active at the same time.
+* The callbacks of pstCBStruct are only invoked for this session, and the WANIFName reported for it identifies its network interface.
+* The session started by cellular_hal_start_network() is the default session and is not affected by this API.
+*
+* @param[in] ip_request_type variable is from the enumerated datatype CellularNetworkIPType_t.
+* @param[in] pstProfileInput - Here needs to pass profile from structure CellularProfileStruct to start the session. It must not be NULL.
+* @param[in] pstCBStruct - Here needs to fill CB function pointer for packet and ip status of this session from the structure CellularNetworkCBStruct.
+* @param[out] session_handle variable is a unsigned integer pointer filled with the handle of the session.
+*                            \n It is never CELLULAR_PACKET_DATA_INVALID_HANDLE.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_ERR if any error is detected or CELLULAR_MAX_DATA_SESSIONS sessions, including the default session, are already active
 *
 */
-int cellular_hal_get_packet_statistics( CellularPacketStatsStruct *network_packet_stats );
+int cellular_hal_start_network_session( CellularNetworkIPType_t ip_request_type, CellularProfileStruct *pstProfileInput, CellularNetworkCBStruct *pstCBStruct, unsigned int *session_handle );
 
 /**
-* @brief - This API get current modem registration status
+* @brief - This API inform lower layer to stop the packet data session identified by session_handle
 *
-* @param[out] status variable is a pointer to the structure CellularInterfaceStatus_t, needs to assign modem current registration status.
+* @param[in] session_handle variable is a unsigned integer holding the handle returned by cellular_hal_start_network_session().
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_ERR if any error is detected or the handle is unknown
 *
 */
-int cellular_hal_get_current_modem_interface_status( CellularInterfaceStatus_t *status );
+int cellular_hal_stop_network_session( unsigned int session_handle );
 
 /**
-* @brief - This API to attach modem with network registration
+* @brief - This API get the IP configuration of a packet data session
+*
+* @param[in] session_handle variable is a unsigned integer holding the handle returned by cellular_hal_start_network_session().
+* @param[in] ip_type variable is from the enumerated datatype CellularNetworkIPType_t selecting the IP family.
+* @param[out] pstIPStruct variable is a structure pointer from CellularIPStruct that needs to be updated.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_ERR if any error is detected, the handle is unknown or the IP family is not configured
 *
 */
-int cellular_hal_set_modem_network_attach( void );
+int cellular_hal_get_session_ip_information( unsigned int session_handle, CellularNetworkIPType_t ip_type, CellularIPStruct *pstIPStruct );
 
 /**
-* @brief - This API to detach modem with network registration
+* @brief - This API get the packet statistics of a packet data session
+*
+* Deltas and rates are computed against prev_stats as described for cellular_hal_get_packet_statistics64().
+*
+* @param[in] session_handle variable is a unsigned integer holding the handle returned by cellular_hal_start_network_session().
+* @param[in] prev_stats variable is a pointer to the CellularPacketStats64Struct returned by the previous call of the caller for this session. Can be NULL.
+* @param[out] network_packet_stats variable is a pointer, needs to parse CellularPacketStats64Struct structure to get packet statistics of the session.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
-* @retval RETURN_ERR if any error is detected
+* @retval RETURN_ERR if any error is detected or the handle is unknown
 *
 */
-int cellular_hal_set_modem_network_detach( void );
+int cellular_hal_get_session_packet_statistics( unsigned int session_handle, CellularPacketStats64Struct *prev_stats, CellularPacketStats64Struct *network_packet_stats );
 
 /**
-* @brief - This API get current firmware version of modem
+* @brief - This API inform lower layer to re-adopt the device, slot and default data session left up by cellular_hal_deinit()
 *
-* @param[out] firmware_version variable is a character pointer contains firmware version of modem.
-*                                \n The buffer size should be atleast 128 bytes long. Example: "v2.1.3".
+* Must be called after cellular_hal_init(). Only the default data session can be re-adopted, because cellular_hal_deinit() stops
+* every session started with cellular_hal_start_network_session(). Such sessions are started again by the caller after resume
+* and get new handles. When an existing default data session is found it is adopted without being torn down:
+* device_open_status_cb reports DEVICE_OPEN_STATUS_READY, packet_service_status_cb reports DEVICE_NETWORK_STATUS_CONNECTED and
+* device_network_ip_ready_cb delivers the current IP configuration, so the caller skips cellular_hal_open_device(),
+* cellular_hal_select_device_slot() and cellular_hal_start_network().
+*
+* @param[in] pstDeviceCtxCB variable is the structure CellularDeviceContextCBStruct receives function pointers for device open/remove status response from driver.
+* @param[in] pstCBStruct - Here needs to fill CB function pointer for packet and ip status from the structure CellularNetworkCBStruct.
+* @param[out] session_resumed variable is a unsigned character pointer.
+*                             \n 1 if the default data session was adopted, 0 if none was found and the caller has to follow the normal start up sequence.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
 *
 */
-int cellular_hal_get_modem_firmware_version(char *firmware_version);
+int cellular_hal_resume(CellularDeviceContextCBStruct *pstDeviceCtxCB, CellularNetworkCBStruct *pstCBStruct, unsigned char *session_resumed);
 
 /**
-* @brief - This API get current plmn information from modem
+* @brief - This API get current signal information from Modem
 *
-* @param[in] plmn_info is a pointer to structure CellularCurrentPlmnInfoStruct that receives function pointers for current plmn network information response from modem.
+* @param[out] signal_info variable is a pointer, needs to parse CellularSignalInfoStruct structure to get signal information.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
 *
 */
-int cellular_hal_get_current_plmn_information(CellularCurrentPlmnInfoStruct *plmn_info);
+int cellular_hal_get_signal_info(CellularSignalInfoStruct *signal_info);
 
 /**
-* @brief - This API get current active card status information from modem
+* @brief - This callback sends to upper layer when a monitored signal metric crossed one of its thresholds.
 *
-* @param[out] network_info is a structure CellularNetworkScanResultInfoStruct filled with available networks information from Modem.
-* @param[out] total_network_count variable is a unsigned integer pointer filled with total no of available networks.
-*                                   \n The possible range of acceptable values is 0 to 1100000. Example: 5
+* @param[in] signal_info variable is a structure pointer from CellularSignalInfoStruct holding all current signal values.
+* @param[in] changed_metric_mask variable is a bitmask of (1 << CellularSignalMetric_t) values for the metrics that triggered the report.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
 *
 */
-int cellular_hal_get_available_networks_information(CellularNetworkScanResultInfoStruct **network_info, unsigned int *total_network_count);
+typedef int (*cellular_device_signal_status_api_callback)( CellularSignalInfoStruct *signal_info, unsigned int changed_metric_mask );
 
 /**
-* @brief - Returns Modem preferred Radio Technologies
+* @brief - This API inform lower layer to monitor signal quality and report threshold crossings instead of being polled.
 *
-* @param[out] preferred_rat variable is a character array contains preferred technology.
-*                             \n The buffer size sholud be atleast 128 bytes long.
-*                             \n Possible combination of strings: AUTO, CDMA20001X, EVDO, GSM, UMTS, LTE
-*                             \n Example: "{UMTS,LTE / WCDMA,LTE}".
+* The lower layer should rely on modem side signal indications so that no wakeup happens while the radio is stable.
+* A later call replaces the previous configuration.
+*
+* @param[in] pstConfig is a pointer to structure CellularSignalMonitorConfigStruct holding per metric thresholds, hysteresis and the minimum report interval.
+* @param[in] signal_status_cb is a function pointer which receives signal reports from lower layer.
+*                            \n If NULL then signal monitoring is stopped.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
 *
 */
-int cellular_hal_get_modem_preferred_radio_technology( char *preferred_rat );
+int cellular_hal_monitor_signal_quality(CellularSignalMonitorConfigStruct *pstConfig, cellular_device_signal_status_api_callback signal_status_cb);
 
 /**
-* @brief - sets Modem preferred Radio Technologies
+* @brief - This API get the signal history kept by the lower layer
 *
-* @param[in] preferred_rat variable is a character array contains preferred technology. Should be part of supported RAT otherwise AUTO will be set.
-*                            \n The buffer size sholud be atleast 128 bytes long.
-*                            \n Possible combination of strings: AUTO, CDMA20001X, EVDO, GSM, UMTS, LTE
-*                            \n Example: "{LTE / AUTO}".
+* Only the process which opened the device samples the signal, once per second while the device is open, and aggregates the
+* samples into fixed size rings of 1 second, 1 minute and 15 minute buckets, so the memory used does not grow over time.
+* The rings are published in the shared memory object CELLULAR_SIGNAL_HISTORY_SHM_NAME, using the same seqlock protocol as
+* CellularSharedStatePageStruct. In every process, this API copies the requested ring from there read-only, without any modem I/O.
+* Buckets are returned oldest first and the bucket in progress is returned last.
+*
+* @param[in] resolution variable is from the enumerated datatype CellularSignalHistoryResolution_t.
+* @param[out] buckets is a caller allocated array of CellularSignalHistoryBucketStruct that needs to be updated.
+* @param[in] max_count variable is a unsigned integer holding the number of entries of buckets.
+*                      \n When fewer entries than the retained buckets are given, the most recent buckets are returned.
+* @param[out] bucket_count variable is a unsigned integer pointer filled with the number of buckets written.
 *
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
 *
 */
-int cellular_hal_set_modem_preferred_radio_technology( char *preferred_rat );
+int cellular_hal_get_signal_history(CellularSignalHistoryResolution_t resolution, CellularSignalHistoryBucketStruct *buckets, unsigned int max_count, unsigned int *bucket_count);
 
 /**
-* @brief - Returns Modem current Radio Technologies
-*
-* @param[out] current_rat variable is a character pointer contains current technology used for data.
-*                             \n The buffer size sholud be atleast 128 bytes long.
-*                             \n Possible strings: AUTO, CDMA20001X, EVDO, GSM, UMTS, LTE
-*                             \n Example: "LTE".
+* @brief - This API gets cell location information. 
 *
+* @param[out] loc_info variable is a pointer, needs to parse CellLocationInfoStruct structure to get location information.                          
 * @return The status of the operation
 * @retval RETURN_OK if successful
 * @retval RETURN_ERR if any error is detected
-*
 */
-int cellular_hal_get_modem_current_radio_technology( char *current_rat );
+int cellular_hal_get_cell_location_info(CellLocationInfoStruct *loc_info);
 
 /**
-* @brief - Returns Modem supported Radio access Technologies
+* @brief - This API gets the serving cell and all measured neighbour cells in a single modem transaction.
 *
-* @param[out] supported_rat variable is a character pointer contains information about supported RAT.
-*                             \n The buffer size sholud be atleast 128 bytes long.
-*                             \n Possible combination of strings: AUTO, CDMA20001X, EVDO, GSM, UMTS, LTE
+* @param[out] cells is a caller allocated array of CellularCellMeasurementStruct that needs to be updated.
+*                   \n The serving cell is always the first entry, neighbour cells follow in descending order of RSRP.
+* @param[in] max_count variable is a unsigned integer holding the number of entries of cells.
+* @param[out] cell_count variable is a unsigned integer pointer filled with the number of cells written.
+*                        \n When more cells were measured than max_count the weakest neighbour cells are dropped.
+* @param[out] total_count variable is a unsigned integer pointer filled with the number of cells measured, including the dropped ones. Can be NULL.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected or the device is not camped on a cell
+*/
+int cellular_hal_get_cell_measurements(CellularCellMeasurementStruct *cells, unsigned int max_count, unsigned int *cell_count, unsigned int *total_count);
+
+/**
+* @brief - This API inform lower layer to configure modem operating mode.
+* @param[in] modem_operating_config variable is from the enumerated datatype needs to pass CellularModemOperatingConfiguration_t to configure modem state.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_set_modem_operating_configuration(CellularModemOperatingConfiguration_t modem_operating_config);
+
+/**
+* @brief - Returns Modem Device IMEI information
+*
+* @param[out] imei variable is a character pointer, needs to return Modem IMEI value on this input.
+*                  \n The buffer size should be atleast 16 bytes long. Example: "010928/00/389023/36".
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_device_imei ( char *imei );
+
+/**
+* @brief - Returns Modem Device IMEI Software Version
+*
+* @param[out] imei_sv variable is a character pointer, needs to return Modem IMEI Software Version value on this input.
+*                     \n The buffer size should be atleast 16 bytes long. Example: 36.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_device_imei_sv ( char *imei_sv );
+
+/**
+* @brief - Returns Modem Device Current ICCID Information
+*
+* @param[out] iccid variable is a character pointer, needs to return currently choosed ICCID value on this input.
+*                   \n The buffer size should be atleast 21 bytes long. Example: "8901260410032962638F".
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_modem_current_iccid ( char *iccid );
+
+/**
+* @brief - Returns Modem Device Current MSISDN Information
+*
+* @param[out] msisdn variable is a character pointer, needs to return currently choosed MSISDN value on this input.
+*                    \n The buffer size should be atleast 20 bytes long. Example: "9386720110".
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_modem_current_msisdn ( char *msisdn );
+
+/**
+* @brief - This API get current network packet statistics from modem
+*
+* @param[out] network_packet_stats variable is a pointer, needs to parse CellularPacketStatsStruct structure to get packet statistics information.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_packet_statistics( CellularPacketStatsStruct *network_packet_stats );
+
+/**
+* @brief - This API get current network packet statistics as 64-bit counters with per interval deltas and rates
+*
+* The counters never wrap during the lifetime of the data session and are reset when a new data session is started.
+* Deltas and rates are computed against the previous sample passed by the caller, so every consumer gets figures for its own interval:
+* - If prev_stats is NULL then IntervalMs, the deltas and the rates are 0.
+* - If prev_stats was taken before SessionStartTimestamp, the counters were reset in between. The deltas are then the counters
+*   themselves and IntervalMs is the time since SessionStartTimestamp, so a delta never underflows.
+* - Otherwise IntervalMs is the time since prev_stats->Timestamp.
+*
+* @param[in] prev_stats variable is a pointer to the CellularPacketStats64Struct returned by the previous call of the caller. Can be NULL.
+* @param[out] network_packet_stats variable is a pointer, needs to parse CellularPacketStats64Struct structure to get packet statistics information.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_packet_statistics64( CellularPacketStats64Struct *prev_stats, CellularPacketStats64Struct *network_packet_stats );
+
+/**
+* @brief - This API select where packet statistics are read from
+*
+* With CELLULAR_PACKET_STATS_SOURCE_NETDEV, cellular_hal_get_packet_statistics() and cellular_hal_get_packet_statistics64() read the
+* byte, packet and drop counters of the WAN interface reported by device_open_status_cb (e.g. "wwan0") from IFLA_STATS64 over a
+* persistent rtnetlink socket, without any modem query. UpStreamMaxBitRate and DownStreamMaxBitRate are not known to the kernel;
+* they are still taken from the modem, refreshed only when the data session or the serving cell changes.
+* Sessions started with cellular_hal_start_network_session() are read from their own interface, the WANIFName reported for them,
+* through cellular_hal_get_session_packet_statistics().
+*
+* Kernel counters are not reset when a data session starts, so the lower layer snapshots them as a baseline at session start and
+* reports the difference, which keeps the counters zero based per session as for the modem source.
+* On a change of source during a session, the new source is baselined against the values reported so far.
+* The reported counters therefore continue from where the previous source left them, without a jump.
+* The default is CELLULAR_PACKET_STATS_SOURCE_MODEM.
+*
+* @param[in] stats_source variable is from the enumerated datatype CellularPacketStatsSource_t.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected or the WAN interface is not known yet
+*
+*/
+int cellular_hal_set_packet_statistics_source( CellularPacketStatsSource_t stats_source );
+
+/**
+* @brief - This API get current modem registration status
+*
+* @param[out] status variable is a pointer to the structure CellularInterfaceStatus_t, needs to assign modem current registration status.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_current_modem_interface_status( CellularInterfaceStatus_t *status );
+
+/**
+* @brief - This API to attach modem with network registration
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_set_modem_network_attach( void );
+
+/**
+* @brief - This API to detach modem with network registration
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_set_modem_network_detach( void );
+
+/**
+* @brief - This API get current firmware version of modem
+*
+* @param[out] firmware_version variable is a character pointer contains firmware version of modem.
+*                                \n The buffer size should be atleast 128 bytes long. Example: "v2.1.3".
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_modem_firmware_version(char *firmware_version);
+
+/**
+* @brief - This API get current plmn information from modem
+*
+* @param[in] plmn_info is a pointer to structure CellularCurrentPlmnInfoStruct that receives function pointers for current plmn network information response from modem.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_current_plmn_information(CellularCurrentPlmnInfoStruct *plmn_info);
+
+/**
+* @brief - This API get the selected telemetry fields from modem in a single vendor transaction.
+*
+* All selected fields are sampled at the same moment, so the snapshot replaces back to back calls to
+* cellular_hal_get_current_modem_interface_status(), cellular_hal_get_signal_info(), cellular_hal_get_current_plmn_information(),
+* cellular_hal_get_cell_location_info() and cellular_hal_get_packet_statistics().
+*
+* @param[in] field_mask variable is a bitmask of CELLULAR_TELEMETRY_FIELD_* values selecting the fields to be filled.
+* @param[out] snapshot is a pointer to structure CellularTelemetrySnapshotStruct that needs to be updated.
+*                      \n On return snapshot->FieldMask holds the subset of field_mask that the HAL was able to fill.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected or none of the selected fields could be filled
+*
+*/
+int cellular_hal_get_telemetry_snapshot(unsigned int field_mask, CellularTelemetrySnapshotStruct *snapshot);
+
+/**
+* @brief - This API get the modem state published in the shared state page without any modem query
+*
+* On first use the page CELLULAR_SHARED_STATE_SHM_NAME is mapped read-only into the calling process.
+* The copy is taken lock-free through the seqlock described in CellularSharedStatePageStruct, so it never blocks the writer.
+*
+* @param[out] state is a pointer to structure CellularSharedStateStruct that needs to be updated.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected, no process has published the state yet or no consistent copy was taken
+*                    \n within CELLULAR_SHARED_STATE_READ_RETRIES retries
+*
+*/
+int cellular_hal_get_shared_state(CellularSharedStateStruct *state);
+
+/**
+* @brief - This API get current active card status information from modem
+*
+* @param[out] network_info is a structure CellularNetworkScanResultInfoStruct filled with available networks information from Modem.
+*                          \n The array is allocated by the HAL and must be released by the caller with free().
+* @param[out] total_network_count variable is a unsigned integer pointer filled with total no of available networks.
+*                                   \n The possible range of acceptable values is 0 to 1100000. Example: 5
+*
+* This API and cellular_hal_get_available_networks_information_async() use the network scan cache like
+* cellular_hal_start_network_scan() with force_refresh 0, and a completed radio scan refreshes the cache.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_available_networks_information(CellularNetworkScanResultInfoStruct **network_info, unsigned int *total_network_count);
+
+/**
+* @brief - This callback sends each network to upper layer as soon as it is found by a streaming network scan
+*
+* @param[in] network_info variable is a structure pointer from CellularNetworkScanResultInfoStruct.
+*                         \n Only valid for CELLULAR_NETWORK_SCAN_RESULT and only for the duration of the callback, otherwise NULL.
+* @param[in] scan_status variable is from the enumerated datatype CellularNetworkScanStatus_t.
+*                        \n Every scan ends with exactly one COMPLETED, CANCELLED or FAILED report.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+typedef int (*cellular_network_scan_result_api_callback)( CellularNetworkScanResultInfoStruct *network_info, CellularNetworkScanStatus_t scan_status );
+
+/**
+* @brief - This API inform lower layer to start a streaming network scan
+*
+* Results are delivered one by one, so apart from the scan cache memory use does not depend on the number of networks found.
+* When the cached results of a previous scan are younger than the configured TTL and force_refresh is 0,
+* they are replayed to the callback without any radio scan. Only one scan can be in progress at a time.
+* A completed radio scan refreshes the cache. A scan which finds more than CELLULAR_NETWORK_SCAN_CACHE_MAX_ENTRIES networks
+* is not cached, so the cache never holds more than CELLULAR_NETWORK_SCAN_CACHE_MAX_ENTRIES entries.
+*
+* @param[in] force_refresh variable is a unsigned character. If 1 then the cache is bypassed and a radio scan is always started.
+* @param[in] scan_result_cb is a function pointer which receives scan results from lower layer.
+*
+* @return The status of the operation
+* @retval RETURN_OK if the scan is started
+* @retval RETURN_ERR if any error is detected or a scan is already in progress
+*
+*/
+int cellular_hal_start_network_scan( unsigned char force_refresh, cellular_network_scan_result_api_callback scan_result_cb );
+
+/**
+* @brief - This API inform lower layer to cancel the streaming network scan in progress
+*
+* The scan callback receives CELLULAR_NETWORK_SCAN_CANCELLED. Results delivered before cancellation are not cached.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected or no scan is in progress
+*
+*/
+int cellular_hal_cancel_network_scan( void );
+
+/**
+* @brief - This API sets the time to live of cached network scan results
+*
+* @param[in] ttl_sec variable is a unsigned integer holding the TTL in seconds. 0 disables the cache and releases the cached results.
+*                    \n Until this API is called the TTL is CELLULAR_NETWORK_SCAN_CACHE_TTL_DEFAULT.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_set_network_scan_cache_ttl( unsigned int ttl_sec );
+
+/**
+* @brief - Returns Modem preferred Radio Technologies
+*
+* @param[out] preferred_rat variable is a character array contains preferred technology.
+*                             \n The buffer size sholud be atleast 128 bytes long.
+*                             \n Possible combination of strings: AUTO, CDMA20001X, EVDO, GSM, UMTS, LTE
+*                             \n Example: "{UMTS,LTE / WCDMA,LTE}".
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_modem_preferred_radio_technology( char *preferred_rat );
+
+/**
+* @brief - sets Modem preferred Radio Technologies
+*
+* @param[in] preferred_rat variable is a character array contains preferred technology. Should be part of supported RAT otherwise AUTO will be set.
+*                            \n The buffer size sholud be atleast 128 bytes long.
+*                            \n Possible combination of strings: AUTO, CDMA20001X, EVDO, GSM, UMTS, LTE
+*                            \n Example: "{LTE / AUTO}".
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_set_modem_preferred_radio_technology( char *preferred_rat );
+
+/**
+* @brief - Returns Modem current Radio Technologies
+*
+* @param[out] current_rat variable is a character pointer contains current technology used for data.
+*                             \n The buffer size sholud be atleast 128 bytes long.
+*                             \n Possible strings: AUTO, CDMA20001X, EVDO, GSM, UMTS, LTE
+*                             \n Example: "LTE".
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_modem_current_radio_technology( char *current_rat );
+
+/**
+* @brief - Returns Modem supported Radio access Technologies
+*
+* @param[out] supported_rat variable is a character pointer contains information about supported RAT.
+*                             \n The buffer size sholud be atleast 128 bytes long.
+*                             \n Possible combination of strings: AUTO, CDMA20001X, EVDO, GSM, UMTS, LTE
 *                             \n Example: "UMTS, LTE".
 *
 * @return The status of the operation
@@ -1029,6 +2014,34 @@ int cellular_hal_get_modem_current_radio_technology( char *current_rat );
 */
 int cellular_hal_get_modem_supported_radio_technology ( char *supported_rat );
 
+/**
+* @brief - This API invalidate the identity and capability cache
+*
+* The values returned by cellular_hal_get_device_imei(), cellular_hal_get_device_imei_sv(), cellular_hal_get_modem_firmware_version(),
+* cellular_hal_get_modem_supported_radio_technology(), cellular_hal_get_modem_current_iccid() and cellular_hal_get_modem_current_msisdn()
+* are read from the modem once after cellular_hal_open_device() succeeds and are then served from the cache.
+* The lower layer invalidates the cache itself on device removal, on slot change, on cellular_hal_modem_reset() and on cellular_hal_modem_factory_reset().
+* This API is only needed when the caller knows of any other change.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_identity_cache_invalidate( void );
+
+/**
+* @brief - This API get the identity and capability cache counters
+*
+* @param[out] cache_stats is a pointer to structure CellularIdentityCacheStatsStruct that needs to be updated.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_identity_cache_stats( CellularIdentityCacheStatsStruct *cache_stats );
+
 /**
 * @brief - This API to factory reset the modem
 *
@@ -1048,5 +2061,245 @@ int cellular_hal_modem_factory_reset( void );
 *
 */
 int cellular_hal_modem_reset( void );
+
+/**
+* @brief - Returns the file descriptor which signals completion of asynchronous requests
+*
+* The descriptor becomes readable while at least one completion is pending and can be added to a poll/epoll loop.
+* It is owned by the HAL and must not be closed or read by the caller; completions are drained with cellular_hal_get_async_completions().
+* This API can be called before cellular_hal_init(). The descriptor and the completion queue are created on the first call of this
+* API or of cellular_hal_init_async(), stay valid across a failed initialisation and are released by cellular_hal_deinit().
+*
+* @param[out] event_fd variable is a integer pointer filled with the event file descriptor.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_event_fd( int *event_fd );
+
+/**
+* @brief - Asynchronous variant of cellular_hal_init(). Returns once the request is queued.
+*
+* Unlike the other asynchronous APIs this API is called before cellular_hal_init(), so it starts the request thread and creates the
+* event descriptor itself. Until the completion with Status RETURN_OK is reported, only cellular_hal_get_event_fd(),
+* cellular_hal_get_async_completions(), cellular_hal_cancel_async_request() and cellular_hal_deinit() can be called.
+* If the initialisation fails, the caller can call this API or cellular_hal_init() again.
+*
+* @param[in] pstCtxInputStruct variable is the Input structure to pass to cellular hal initialization function described by the CellularContextInitInputStruct.
+*                             \n The content is copied before the call returns.
+* @param[out] request_id variable is a unsigned integer pointer filled with the ID reported in CellularAsyncCompletionStruct.
+*
+* @return The status of the operation
+* @retval RETURN_OK if the request is queued
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_init_async( CellularContextInitInputStruct *pstCtxInputStruct, unsigned int *request_id );
+
+/**
+* @brief - Asynchronous variant of cellular_hal_start_network(). Returns once the request is queued.
+*
+* @param[in] ip_request_type variable is from the enumerated datatype CellularNetworkIPType_t.
+* @param[in] pstProfileInput - Profile from structure CellularProfileStruct to start network. If NULL then the default profile is used.
+*                            \n The content is copied before the call returns.
+* @param[in] pstCBStruct - CB function pointers for packet and ip status from the structure CellularNetworkCBStruct.
+* @param[out] request_id variable is a unsigned integer pointer filled with the ID reported in CellularAsyncCompletionStruct.
+*
+* @return The status of the operation
+* @retval RETURN_OK if the request is queued
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_start_network_async( CellularNetworkIPType_t ip_request_type, CellularProfileStruct *pstProfileInput, CellularNetworkCBStruct *pstCBStruct, unsigned int *request_id );
+
+/**
+* @brief - Asynchronous variant of cellular_hal_set_modem_network_attach(). Returns once the request is queued.
+*
+* @param[out] request_id variable is a unsigned integer pointer filled with the ID reported in CellularAsyncCompletionStruct.
+*
+* @return The status of the operation
+* @retval RETURN_OK if the request is queued
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_set_modem_network_attach_async( unsigned int *request_id );
+
+/**
+* @brief - Asynchronous variant of cellular_hal_get_available_networks_information(). Returns once the request is queued.
+*
+* @param[out] request_id variable is a unsigned integer pointer filled with the ID reported in CellularAsyncCompletionStruct.
+*
+* @return The status of the operation
+* @retval RETURN_OK if the request is queued
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_available_networks_information_async( unsigned int *request_id );
+
+/**
+* @brief - This API drain pending asynchronous completions in a batch
+*
+* @param[out] completions is a caller allocated array of CellularAsyncCompletionStruct that needs to be updated.
+* @param[in] max_count variable is a unsigned integer holding the number of entries of completions.
+* @param[out] completion_count variable is a unsigned integer pointer filled with the number of entries written. 0 if nothing is pending.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_async_completions( CellularAsyncCompletionStruct *completions, unsigned int max_count, unsigned int *completion_count );
+
+/**
+* @brief - Sets the deadline applied to every subsequent cellular_hal_* call made by the calling thread
+*
+* A call which does not complete within timeout_ms returns RETURN_TIMEOUT and leaves the modem in a consistent state.
+* The setting is per thread and stays in effect until changed.
+*
+* @param[in] timeout_ms variable is a unsigned integer holding the deadline in milliseconds. 0 disables the deadline.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_set_call_timeout( unsigned int timeout_ms );
+
+/**
+* @brief - Returns the deadline applied to cellular_hal_* calls made by the calling thread
+*
+* @param[out] timeout_ms variable is a unsigned integer pointer filled with the deadline in milliseconds. 0 if no deadline is set.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_call_timeout( unsigned int *timeout_ms );
+
+/**
+* @brief - This API cancel the blocking cellular_hal_* call in progress in another thread
+*
+* The cancelled call returns RETURN_CANCELLED.
+*
+* @param[in] thread_id variable is the pthread_t of the thread whose call needs to be cancelled.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected or the thread has no call in progress
+*
+*/
+int cellular_hal_cancel_call( pthread_t thread_id );
+
+/**
+* @brief - This API cancel an asynchronous request
+*
+* The completion of the request is still reported, with Status set to RETURN_CANCELLED.
+*
+* @param[in] request_id variable is a unsigned integer holding the ID returned when the request was submitted.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected or the request has already completed
+*
+*/
+int cellular_hal_cancel_async_request( unsigned int request_id );
+
+/**
+* @brief - This API get the call statistics of every cellular_hal_* API
+*
+* Statistics are collected by the HAL with lock-free counters and cover the calls made by the calling process since
+* cellular_hal_init() or the last cellular_hal_reset_api_stats().
+*
+* @param[out] api_stats is a caller allocated array of CellularApiStatsStruct that needs to be updated.
+*                       \n If NULL then only api_count is returned.
+* @param[in] max_count variable is a unsigned integer holding the number of entries of api_stats.
+* @param[out] api_count variable is a unsigned integer pointer filled with the number of instrumented APIs.
+*                       \n When it is greater than max_count only the first max_count entries are written.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_api_stats( CellularApiStatsStruct *api_stats, unsigned int max_count, unsigned int *api_count );
+
+/**
+* @brief - This API reset the call statistics of every cellular_hal_* API
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_reset_api_stats( void );
+
+/**
+* @brief - This API read the state events recorded in the event journal after a given sequence number
+*
+* Every event reported through a callback is also recorded in a lock-free ring buffer of CELLULAR_EVENT_JOURNAL_SIZE entries,
+* whether or not a callback is registered, so a slow consumer, or a handler which was re-registered, can catch up on missed events.
+* The journal lives in the HAL instance of the calling process: it starts empty at cellular_hal_init() and is released by
+* cellular_hal_deinit(), so it does not survive a restart of that process. After a restart, current state is read with the getters.
+* Events are returned oldest first. To read all following events, pass the Sequence of the last returned event as since_seq.
+*
+* @param[in] since_seq variable holds the sequence number of the last event already read by the caller. 0 reads from the oldest retained event.
+* @param[out] events is a caller allocated array of CellularEventStruct that needs to be updated.
+* @param[in] max_count variable is a unsigned integer holding the number of entries of events.
+* @param[out] event_count variable is a unsigned integer pointer filled with the number of events written.
+* @param[out] lost_count variable is a unsigned integer pointer filled with the number of events after since_seq which were
+*                        \n already overwritten in the ring buffer and cannot be returned. Can be NULL.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_read_events( uint64_t since_seq, CellularEventStruct *events, unsigned int max_count, unsigned int *event_count, unsigned int *lost_count );
+
+/**
+* @brief - This API configure the queue through which callbacks are delivered
+*
+* Modem I/O threads post events to a bounded multi-producer queue and never call consumer code directly.
+* A dedicated dispatcher thread drains the queue and invokes the registered callbacks, so a slow callback only delays
+* later callbacks. Every callback registered with the HAL goes through the queue:
+* - state events: device open and removed status, slot status, registration status, profile status, packet service status,
+*   IP ready (device_network_ip_ready_cb), binary IP configuration (cellular_hal_register_ip_config_cb()) and connect status;
+* - report events: signal reports (cellular_hal_monitor_signal_quality()) and network scan results (cellular_hal_start_network_scan()).
+*
+* With coalescing enabled a queued state event is replaced by a newer one of the same type and key, e.g. registration status,
+* slot status of the same slot or packet service status of the same IP family and session. Queued signal reports are replaced
+* by the newer report, and the changed_metric_mask of the replacing report is OR'd with the mask of the report it replaces, so
+* no metric crossing is lost. Scan results are never coalesced.
+*
+* State events are never dropped. Each state type and key has one reserved entry outside the QueueSize report entries, and when
+* that entry is still queued a new state event replaces it even with coalescing disabled, so the latest state is always delivered.
+* Only report events posted by modem I/O threads are dropped when the queue is full, and they are counted in Dropped. If a scan
+* result is dropped the scan ends with CELLULAR_NETWORK_SCAN_FAILED, so the caller knows the result list is incomplete.
+* Producers that are not modem I/O threads, such as the replay of cached scan results, wait for space instead of dropping.
+* Every state event is also recorded in the event journal.
+*
+* @param[in] pstConfig is a pointer to structure CellularCallbackDispatchConfigStruct holding the queue configuration.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_set_callback_dispatch_config( CellularCallbackDispatchConfigStruct *pstConfig );
+
+/**
+* @brief - This API get the counters of the callback dispatch queue
+*
+* @param[out] pstStats is a pointer to structure CellularCallbackDispatchStatsStruct that needs to be updated.
+*
+* @return The status of the operation
+* @retval RETURN_OK if successful
+* @retval RETURN_ERR if any error is detected
+*
+*/
+int cellular_hal_get_callback_dispatch_stats( CellularCallbackDispatchStatsStruct *pstStats );
 /** @} */  //END OF GROUP CELLULAR_HAL_APIS
 #endif //_CELLULAR_HAL_H_